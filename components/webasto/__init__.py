@@ -0,0 +1,80 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.components import uart
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["uart"]
+
+CONF_WEBASTO_ID = "webasto_id"
+
+webasto_ns = cg.esphome_ns.namespace("webasto")
+Webasto = webasto_ns.class_("Webasto", cg.Component, uart.UARTDevice)
+
+HeatOnAction = webasto_ns.class_("HeatOnAction", automation.Action)
+VentOnAction = webasto_ns.class_("VentOnAction", automation.Action)
+OffAction = webasto_ns.class_("OffAction", automation.Action)
+
+CONFIG_SCHEMA = (
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(Webasto),
+        }
+    )
+    .extend(cv.COMPONENT_SCHEMA)
+    .extend(uart.UART_DEVICE_SCHEMA)
+)
+
+FINAL_VALIDATE_SCHEMA = uart.final_validate_device_schema(
+    "webasto",
+    baud_rate=2400,
+    require_tx=True,
+    require_rx=True,
+    parity="EVEN",
+    stop_bits=1,
+)
+
+
+def request_state_page(page):
+    """Compile in polling and decoding of W-Bus status page 0x50 <page>."""
+    cg.add_define(f"USE_WEBASTO_STATE_50_{page:02X}")
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await uart.register_uart_device(var, config)
+
+
+WEBASTO_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.GenerateID(): cv.use_id(Webasto),
+    }
+)
+
+
+async def webasto_action_to_code(define, config, action_id, template_arg):
+    cg.add_define(define)
+    paren = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, paren)
+
+
+@automation.register_action("webasto.heat_on", HeatOnAction, WEBASTO_ACTION_SCHEMA)
+async def webasto_heat_on_to_code(config, action_id, template_arg, args):
+    return await webasto_action_to_code(
+        "USE_WEBASTO_CMD_ON_PH", config, action_id, template_arg
+    )
+
+
+@automation.register_action("webasto.vent_on", VentOnAction, WEBASTO_ACTION_SCHEMA)
+async def webasto_vent_on_to_code(config, action_id, template_arg, args):
+    return await webasto_action_to_code(
+        "USE_WEBASTO_CMD_ON_VENT", config, action_id, template_arg
+    )
+
+
+@automation.register_action("webasto.off", OffAction, WEBASTO_ACTION_SCHEMA)
+async def webasto_off_to_code(config, action_id, template_arg, args):
+    return await webasto_action_to_code(
+        "USE_WEBASTO_CMD_OFF", config, action_id, template_arg
+    )
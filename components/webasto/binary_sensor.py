@@ -0,0 +1,47 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import binary_sensor
+from . import CONF_WEBASTO_ID, Webasto, request_state_page
+
+DEPENDENCIES = ["webasto"]
+
+CONF_HEAT_REQUEST = "heat_request"
+CONF_VENT_REQUEST = "vent_request"
+CONF_BIT3 = "bit3"
+CONF_BIT4 = "bit4"
+CONF_COMBUSTION_FAN = "combustion_fan"
+CONF_GLOWPLUG = "glowplug"
+CONF_FUEL_PUMP = "fuel_pump"
+CONF_NOZZLE_HEATING = "nozzle_heating"
+
+# all binary sensors are decoded from status page 0x03
+BINARY_SENSORS = [
+    CONF_HEAT_REQUEST,
+    CONF_VENT_REQUEST,
+    CONF_BIT3,
+    CONF_BIT4,
+    CONF_COMBUSTION_FAN,
+    CONF_GLOWPLUG,
+    CONF_FUEL_PUMP,
+    CONF_NOZZLE_HEATING,
+]
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_WEBASTO_ID): cv.use_id(Webasto),
+        **{
+            cv.Optional(key): binary_sensor.binary_sensor_schema()
+            for key in BINARY_SENSORS
+        },
+    }
+)
+
+
+async def to_code(config):
+    hub = await cg.get_variable(config[CONF_WEBASTO_ID])
+    for key in BINARY_SENSORS:
+        if key not in config:
+            continue
+        request_state_page(0x03)
+        sens = await binary_sensor.new_binary_sensor(config[key])
+        cg.add(getattr(hub, f"set_{key}_binary_sensor")(sens))
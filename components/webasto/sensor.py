@@ -0,0 +1,114 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_TEMPERATURE,
+    CONF_VOLTAGE,
+    DEVICE_CLASS_DURATION,
+    DEVICE_CLASS_TEMPERATURE,
+    DEVICE_CLASS_VOLTAGE,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_CELSIUS,
+    UNIT_EMPTY,
+    UNIT_HERTZ,
+    UNIT_HOUR,
+    UNIT_OHM,
+    UNIT_PERCENT,
+    UNIT_VOLT,
+)
+from . import CONF_WEBASTO_ID, Webasto, request_state_page
+
+DEPENDENCIES = ["webasto"]
+
+CONF_GLOWPLUG = "glowplug"
+CONF_FUEL_PUMP = "fuel_pump"
+CONF_COMBUSTION_FAN = "combustion_fan"
+CONF_GLOWPLUG_RESISTANCE = "glowplug_resistance"
+CONF_WORKING_HOURS = "working_hours"
+CONF_OPERATING_HOURS = "operating_hours"
+CONF_START_COUNTER = "start_counter"
+CONF_OP_STATE = "op_state"
+
+# sensor -> status page it is decoded from
+SENSORS = {
+    CONF_GLOWPLUG: 0x04,
+    CONF_FUEL_PUMP: 0x04,
+    CONF_COMBUSTION_FAN: 0x04,
+    CONF_TEMPERATURE: 0x05,
+    CONF_VOLTAGE: 0x05,
+    CONF_GLOWPLUG_RESISTANCE: 0x05,
+    CONF_WORKING_HOURS: 0x06,
+    CONF_OPERATING_HOURS: 0x06,
+    CONF_START_COUNTER: 0x06,
+    CONF_OP_STATE: 0x07,
+}
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_WEBASTO_ID): cv.use_id(Webasto),
+        cv.Optional(CONF_GLOWPLUG): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_FUEL_PUMP): sensor.sensor_schema(
+            unit_of_measurement=UNIT_HERTZ,
+            accuracy_decimals=2,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_COMBUSTION_FAN): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_TEMPERATURE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_CELSIUS,
+            accuracy_decimals=1,
+            device_class=DEVICE_CLASS_TEMPERATURE,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_VOLTAGE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_VOLT,
+            accuracy_decimals=1,
+            device_class=DEVICE_CLASS_VOLTAGE,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_GLOWPLUG_RESISTANCE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_OHM,
+            accuracy_decimals=3,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_WORKING_HOURS): sensor.sensor_schema(
+            unit_of_measurement=UNIT_HOUR,
+            accuracy_decimals=2,
+            device_class=DEVICE_CLASS_DURATION,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+        ),
+        cv.Optional(CONF_OPERATING_HOURS): sensor.sensor_schema(
+            unit_of_measurement=UNIT_HOUR,
+            accuracy_decimals=2,
+            device_class=DEVICE_CLASS_DURATION,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+        ),
+        cv.Optional(CONF_START_COUNTER): sensor.sensor_schema(
+            unit_of_measurement=UNIT_EMPTY,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+        ),
+        cv.Optional(CONF_OP_STATE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_EMPTY,
+            accuracy_decimals=0,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    hub = await cg.get_variable(config[CONF_WEBASTO_ID])
+    for key, page in SENSORS.items():
+        if key not in config:
+            continue
+        request_state_page(page)
+        sens = await sensor.new_sensor(config[key])
+        cg.add(getattr(hub, f"set_{key}_sensor")(sens))
@@ -0,0 +1,537 @@
+#include "webasto.h"
+#include "esphome/core/log.h"
+#if defined(USE_ESP32) && defined(USE_ARDUINO)
+#include "esphome/components/uart/uart_component_esp32_arduino.h"
+#endif
+
+namespace esphome {
+namespace webasto {
+
+static const char *const TAG = "Webasto";
+
+void Webasto::set_bus_baud_rate(uint32_t baud_rate) {
+#if defined(USE_ESP32) && defined(USE_ARDUINO)
+  // only change the divider, as the original custom component did
+  static_cast<uart::ESP32ArduinoUARTComponent *>(this->parent_)->get_hw_serial()->updateBaudRate(baud_rate);
+#else
+  // no baud-only API here, reinstall the UART driver with the new rate
+  this->parent_->set_baud_rate(baud_rate);
+  this->parent_->load_settings(false);
+#endif
+}
+
+void Webasto::SendBreak() {
+  unsigned long now = millis();
+  if (now - last_ok_rx >= send_break_periode) {
+    ESP_LOGD(TAG, "SendBreak");
+
+    // wait for empty tx buffer
+    this->flush();
+    // empty rx buffer
+    uint8_t waste;
+    while (this->available() > 0) this->read_byte(&waste);
+
+    // send magic byte with slow baudrate for 25ms LOW level
+    uint32_t baud_rate = this->parent_->get_baud_rate();
+    set_bus_baud_rate(300);
+    this->write_byte(0b10000000);
+    this->flush();
+
+    // empty RX system buffer, wait for 0b10000000 = wait 25ms with HIGH level
+    unsigned long rxstr = millis();
+    while ((millis() - rxstr) < 50) {
+      if (this->available()) {
+        this->read_byte(&waste);
+        break;
+      }
+      else delay(1);
+    }
+
+    // restore baudrate
+    set_bus_baud_rate(baud_rate);
+  } else {
+    ESP_LOGD(TAG, "SendBreak not needed, last good rx before: %lu ms", now - last_ok_rx);
+  }
+}
+
+bool Webasto::tx_msg2(uint8_t* dat, uint8_t len) {
+  ESP_LOGD(TAG, "tx_msg start");
+  uint8_t txbuf[40];
+  txbuf[0] = ((WBUS_CLIENT_ADDR << 4) | WBUS_HOST_ADDR);
+  txbuf[1] = len + 1;
+  uint8_t txcnt = 2;
+  for (uint8_t i = 0; i < len; ) {
+    txbuf[txcnt++] = dat[i++];
+  }
+  // make checksum
+  uint8_t chks = 0;
+  for (uint8_t i = 0; i < txcnt; i++) chks ^= txbuf[i];
+  txbuf[txcnt++] = chks;
+  // Log
+  ESP_LOGD(TAG, "TX: %s", format_hex_pretty(txbuf, txcnt).c_str());
+  // empty RX system buffer
+  uint8_t waste;
+  while (this->available() > 0) this->read_byte(&waste);
+  // Send message
+  this->write_array(&txbuf[0], txcnt);
+  this->flush();
+  // Receive own message
+  uint8_t rxbuf[40];
+  uint8_t rxcnt = 0;
+  unsigned long rxstr = millis();
+  while (rxcnt < txcnt && (millis() - rxstr) < 100) {
+    if (this->available()) this->read_byte(&rxbuf[rxcnt++]);
+    else delay(1);
+  }
+  ESP_LOGD(TAG, "RX: %s", format_hex_pretty(rxbuf, rxcnt).c_str());
+  // compare RX with TX
+  bool ok = txcnt == rxcnt;
+  for (uint8_t i = 0; ok && i < txcnt; i++) {
+    ok = txbuf[i] == rxbuf[i];
+  }
+  if (ok) ESP_LOGD(TAG, "tx_msg done: ok");
+  else    ESP_LOGD(TAG, "tx_msg done: error");
+  return ok;
+}
+
+bool Webasto::rx_msg2(uint8_t* dat, uint8_t len) {
+  ESP_LOGD(TAG, "rx_msg start");
+  // Receive message
+  uint8_t rx_len = len + 3;
+  uint8_t rxbuf[40];
+  uint8_t rxcnt = 0;
+  unsigned long rxstr = millis();
+  unsigned long timeout = 200;
+  long delta = 0;
+  while (rxcnt < rx_len && delta < timeout) {
+    if (this->available()) this->read_byte(&rxbuf[rxcnt++]);
+    else delay(1);
+    delta = millis() - rxstr;
+  }
+  // check timeout
+  bool ok_time = delta < timeout;
+  ESP_LOGD(TAG, "Time msg: %03ld, max: %03ld -> %s", delta, timeout, ok_time ? "ok" : "error");
+  // check rx_len
+  bool ok_rxcnt = rxcnt == rx_len;
+  ESP_LOGD(TAG, "RXLEN msg: %02X, cal: %02X -> %s", rxcnt, rx_len, ok_rxcnt ? "ok" : "error");
+  // log
+  ESP_LOGD(TAG, "RX %u bytes: %s", rxcnt, format_hex_pretty(rxbuf, rxcnt).c_str());
+  //ckeck address
+  bool ok_addr = rxbuf[0] == ((WBUS_HOST_ADDR << 4) | WBUS_CLIENT_ADDR);
+  ESP_LOGD(TAG, "ADDR msg: %02X, cal: %02X -> %s", rxbuf[0], ((WBUS_HOST_ADDR << 4) | WBUS_CLIENT_ADDR), ok_addr ? "ok" : "error");
+  //ckeck length byte
+  bool ok_len = rxbuf[1] == rxcnt - 2;
+  ESP_LOGD(TAG, "LEN msg: %02X, cal: %02X -> %s", rxbuf[1], rxcnt - 2, ok_len ? "ok" : "error");
+  // ckeck checksum
+  uint8_t chks = 0;
+  for (uint8_t i = 0; i < rxcnt - 1; i++) chks ^= rxbuf[i];
+  bool ok_chks = rxbuf[rxcnt - 1] == chks;
+  ESP_LOGD(TAG, "CHKS msg: %02X, cal: %02X -> %s", rxbuf[rxcnt - 1], chks, ok_chks ? "ok" : "error");
+
+  bool ok = ok_time && ok_rxcnt && ok_addr && ok_len && ok_chks;
+  if (ok) memcpy(&dat[0], &rxbuf[2], len);
+  if (ok) last_ok_rx = millis();
+  ESP_LOGD(TAG, "rx_msg done: %s", ok ? "ok" : "error");
+  return ok;
+}
+
+#if defined(USE_WEBASTO_CMD_ON_PH) || defined(USE_WEBASTO_CMD_ON_VENT)
+bool Webasto::send_on(const char *name, uint8_t cmd, uint8_t t_on_mins) {
+  ESP_LOGD(TAG, "Send %s", name);
+  uint8_t tx_dat[] = {cmd, t_on_mins};
+  uint8_t rx_dat[sizeof(tx_dat)];
+  for (uint8_t i = 0; i < 3; i++) { // tries
+    SendBreak();
+    if (!tx_msg2(tx_dat, sizeof(tx_dat))) {
+      ESP_LOGE(TAG, "%s !tx_ok", name);
+      continue;
+    }
+    if (!rx_msg2(rx_dat, sizeof(rx_dat))) {
+      ESP_LOGE(TAG, "%s !rx_ok", name);
+      continue;
+    }
+    if ((tx_dat[0] | 0x80) != rx_dat[0]) {
+      ESP_LOGE(TAG, "%s !cmd_ok", name);
+      continue;
+    }
+    if (tx_dat[1] != rx_dat[1]) {
+      ESP_LOGE(TAG, "%s !subcmd_ok", name);
+      continue;
+    }
+    keep_alive_cmd  = cmd;
+    keep_alive_time = (unsigned long)t_on_mins * 60 * 1000;
+    return true;
+  }
+  return false;
+}
+#endif
+
+#ifdef USE_WEBASTO_CMD_ON_VENT
+void Webasto::VentOn(uint8_t t_on_mins) {
+  send_on("VentOn", WBUS_CMD_ON_VENT, t_on_mins);
+}
+#endif
+
+#ifdef USE_WEBASTO_CMD_ON_PH
+void Webasto::HeatOn(uint8_t t_on_mins) {
+  send_on("HeatOn", WBUS_CMD_ON_PH, t_on_mins);
+}
+#endif
+
+#ifdef USE_WEBASTO_CMD_OFF
+void Webasto::Off() {
+  ESP_LOGD(TAG, "Send Off");
+  uint8_t tx_dat[] = {WBUS_CMD_OFF};
+  uint8_t rx_dat[sizeof(tx_dat)];
+  for (uint8_t i = 0; i < 3; i++) { // tries
+    SendBreak();
+    if (!tx_msg2(tx_dat, sizeof(tx_dat))) {
+      ESP_LOGE(TAG, "Off !tx_ok");
+      continue;
+    }
+    if (!rx_msg2(rx_dat, sizeof(rx_dat))) {
+      ESP_LOGE(TAG, "Off !rx_ok");
+      continue;
+    }
+    if ((tx_dat[0] | 0x80) != rx_dat[0]) {
+      ESP_LOGE(TAG, "Off !cmd_ok");
+      continue;
+    }
+#ifdef USE_WEBASTO_KEEP_ALIVE
+    keep_alive_cmd  = 0;
+    keep_alive_time = 0;
+#endif
+    break;
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_KEEP_ALIVE
+void Webasto::KeepAlive() {
+  const unsigned long periode = 10000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    if (keep_alive_cmd > 0 && keep_alive_time > 0) {
+      ESP_LOGD(TAG, "Send KeepAlive");
+      uint8_t tx_dat[] = {WBUS_CMD_CHK, keep_alive_cmd, 0};
+      uint8_t rx_dat[2];
+      for (uint8_t i = 0; i < 3; i++) { // tries
+        SendBreak();
+        if (!tx_msg2(tx_dat, sizeof(tx_dat))) {
+          ESP_LOGE(TAG, "KeepAlive !tx_ok");
+          continue;
+        }
+        if (!rx_msg2(rx_dat, sizeof(rx_dat))) {
+          ESP_LOGE(TAG, "KeepAlive !rx_ok");
+          continue;
+        }
+        if ((tx_dat[0] | 0x80) != rx_dat[0]) {
+          ESP_LOGE(TAG, "KeepAlive !cmd_ok");
+          continue;
+        }
+        if (keep_alive_time > periode) keep_alive_time -= periode;
+        else keep_alive_time = 0;
+        break;
+      }
+    }
+    if (keep_alive_cmd > 0 && keep_alive_time < 30 * 1000) {
+      ESP_LOGD(TAG, "Send ReNew");
+      send_on(keep_alive_cmd == WBUS_CMD_ON_VENT ? "VentOn" : "HeatOn", keep_alive_cmd, 1);
+    }
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE
+bool Webasto::query_state(uint8_t page, uint8_t* dat, uint8_t len) {
+  uint8_t tx_dat[] = {WBUS_CMD_STATE, page};
+  SendBreak();
+  if (!tx_msg2(tx_dat, sizeof(tx_dat))) {
+    ESP_LOGE(TAG, "50_%02X !tx_ok", page);
+    return false;
+  }
+  if (!rx_msg2(dat, len)) {
+    ESP_LOGE(TAG, "50_%02X !rx_ok", page);
+    return false;
+  }
+  if ((tx_dat[0] | 0x80) != dat[0]) {
+    ESP_LOGE(TAG, "50_%02X !cmd_ok", page);
+    return false;
+  }
+  if (tx_dat[1] != dat[1]) {
+    ESP_LOGE(TAG, "50_%02X !subcmd_ok", page);
+    return false;
+  }
+  return true;
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_03
+void Webasto::get_state_50_03() {
+  const unsigned long periode = 5000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    ESP_LOGD(TAG, "get_state_50_03");
+    /*
+        0x01 Heat request
+        0x02 Vent request
+        0x04 ?
+        0x08 ?
+        0x10 Combustion Fan
+        0x20 Glowplug
+        0x40 Fuel Pump
+        0x80 Nozzle heating
+        ? Circulation Pump
+    */
+    uint8_t rx_dat[2 + 1];
+    if (!query_state(0x03, rx_dat, sizeof(rx_dat))) return;
+
+    bool heat_request, vent_request, bit3, bit4, combustion_fan, glowplug, fuel_pump, nozzle_heating;
+
+    heat_request     = rx_dat[2] & 0x01;
+    vent_request     = rx_dat[2] & 0x02;
+    bit3             = rx_dat[2] & 0x04;
+    bit4             = rx_dat[2] & 0x08;
+    combustion_fan   = rx_dat[2] & 0x10;
+    glowplug         = rx_dat[2] & 0x20;
+    fuel_pump        = rx_dat[2] & 0x40;
+    nozzle_heating   = rx_dat[2] & 0x80;
+
+    ESP_LOGD(TAG, "Heat Request:     %s", heat_request     ? "on" : "off");
+    ESP_LOGD(TAG, "Vent Request:     %s", vent_request     ? "on" : "off");
+    ESP_LOGD(TAG, "Bit3:             %s", bit3             ? "on" : "off");
+    ESP_LOGD(TAG, "Bit4:             %s", bit4             ? "on" : "off");
+    ESP_LOGD(TAG, "Combustion Fan:   %s", combustion_fan   ? "on" : "off");
+    ESP_LOGD(TAG, "Glowplug:         %s", glowplug         ? "on" : "off");
+    ESP_LOGD(TAG, "Fuel Pump:        %s", fuel_pump        ? "on" : "off");
+    ESP_LOGD(TAG, "Nozzle Heating:   %s", nozzle_heating   ? "on" : "off");
+
+    if (heat_request_binary_sensor_   != nullptr) heat_request_binary_sensor_->publish_state(heat_request);
+    if (vent_request_binary_sensor_   != nullptr) vent_request_binary_sensor_->publish_state(vent_request);
+    if (bit3_binary_sensor_           != nullptr) bit3_binary_sensor_->publish_state(bit3);
+    if (bit4_binary_sensor_           != nullptr) bit4_binary_sensor_->publish_state(bit4);
+    if (combustion_fan_binary_sensor_ != nullptr) combustion_fan_binary_sensor_->publish_state(combustion_fan);
+    if (glowplug_binary_sensor_       != nullptr) glowplug_binary_sensor_->publish_state(glowplug);
+    if (fuel_pump_binary_sensor_      != nullptr) fuel_pump_binary_sensor_->publish_state(fuel_pump);
+    if (nozzle_heating_binary_sensor_ != nullptr) nozzle_heating_binary_sensor_->publish_state(nozzle_heating);
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_04
+void Webasto::get_state_50_04() {
+  const unsigned long periode = 5000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    ESP_LOGD(TAG, "get_state_50_04");
+    /*
+        byte0: Unknown
+        byte1: Unknown
+        byte2: Unknown
+        byte3: Unknown
+        byte4: Glowplug %
+        byte5: Fuel Pump Hz
+        byte6: Combustion Fan %
+        byte7: Unknown
+    */
+    uint8_t rx_dat[2 + 8];
+    if (!query_state(0x04, rx_dat, sizeof(rx_dat))) return;
+
+    float glowplug, fuel_pump, combustion_fan;
+
+    glowplug       = (float)rx_dat[6]; // 0-100 %
+    fuel_pump      = (float)rx_dat[7] * 2.0 / 100.0; // 0-5 Hz
+    combustion_fan = (float)rx_dat[8]; // 0-200 %
+
+    ESP_LOGD(TAG, "Glowplug:      %03.0f %%" , glowplug);
+    ESP_LOGD(TAG, "Fuel Pump:     %04.2f Hz" , fuel_pump);
+    ESP_LOGD(TAG, "Combustin Fan: %03.0f %%" , combustion_fan);
+
+    if (glowplug_sensor_       != nullptr) glowplug_sensor_->publish_state(glowplug);
+    if (fuel_pump_sensor_      != nullptr) fuel_pump_sensor_->publish_state(fuel_pump);
+    if (combustion_fan_sensor_ != nullptr) combustion_fan_sensor_->publish_state(combustion_fan);
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_05
+void Webasto::get_state_50_05() {
+  const unsigned long periode = 5000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    ESP_LOGD(TAG, "get_state_50_05");
+    /*
+        byte0: Temperature
+        byte1: Voltage
+        byte2: Flame detector resistance
+    */
+    uint8_t rx_dat[2 + 3];
+    if (!query_state(0x05, rx_dat, sizeof(rx_dat))) return;
+
+    float temperature, voltage, glowplug_resistance;
+
+    { const float x[] = {186, 71};
+      const float y[] = { 18, 72};
+      const float m = (y[1] - y[0]) / (x[1] - x[0]);
+      const float n = y[0] - m * x[0];
+      temperature         = m * (float)rx_dat[2] + n;
+    }
+    { const float x[] = { 195,  180};
+      const float y[] = {13.4, 12.0};
+      const float m = (y[1] - y[0]) / (x[1] - x[0]);
+      const float n = y[0] - m * x[0];
+      voltage             = m * (float)rx_dat[3] + n;
+    }
+    { const float x[] = { 51, 108};
+      const float y[] = {0.8, 1.1};
+      const float m = (y[1] - y[0]) / (x[1] - x[0]);
+      const float n = y[0] - m * x[0];
+      glowplug_resistance = rx_dat[4] > 0 ? m * (float)rx_dat[4] + n : 0;
+    }
+
+    ESP_LOGD(TAG, "Temperature:         %+05.1f C", temperature);
+    ESP_LOGD(TAG, "Voltage:             %04.1f V" , voltage);
+    ESP_LOGD(TAG, "Glowplug Resistance: %05.3f Ω" , glowplug_resistance);
+
+    if (temperature_sensor_         != nullptr) temperature_sensor_->publish_state(temperature);
+    if (voltage_sensor_             != nullptr) voltage_sensor_->publish_state(voltage);
+    if (glowplug_resistance_sensor_ != nullptr) glowplug_resistance_sensor_->publish_state(glowplug_resistance);
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_06
+void Webasto::get_state_50_06() {
+  const unsigned long periode = 30000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    ESP_LOGD(TAG, "get_state_50_06");
+    /*
+          byte0,1: Working hours
+          byte2:   Working minutes
+          byte3,4: Operating hours
+          byte5:   Operating minutes
+          byte6,7: Start counter
+    */
+    uint8_t rx_dat[2 + 8];
+    if (!query_state(0x06, rx_dat, sizeof(rx_dat))) return;
+
+    float working_hours, operating_hours;
+    uint16_t start_counter;
+
+    working_hours   = 256 * (float)rx_dat[2] + (float)rx_dat[3] + (float)rx_dat[4] / 60;
+    operating_hours = 256 * (float)rx_dat[5] + (float)rx_dat[6] + (float)rx_dat[7] / 60;
+    start_counter   = 256 * (uint16_t)rx_dat[8] + (uint16_t)rx_dat[9];
+
+    ESP_LOGD(TAG, "Working Hours:   %07.2f h", working_hours);
+    ESP_LOGD(TAG, "Operating Hours: %07.2f h", operating_hours);
+    ESP_LOGD(TAG, "Start Counter:   %04u"    , start_counter);
+
+    if (working_hours_sensor_   != nullptr) working_hours_sensor_->publish_state(working_hours);
+    if (operating_hours_sensor_ != nullptr) operating_hours_sensor_->publish_state(operating_hours);
+    if (start_counter_sensor_   != nullptr) start_counter_sensor_->publish_state(start_counter);
+  }
+}
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_07
+void Webasto::get_state_50_07() {
+  const unsigned long periode = 5000;
+  unsigned long now = millis();
+  static unsigned long last = now - periode;
+  if (now - last >= periode) {
+    last += periode;
+    ESP_LOGD(TAG, "get_state_50_07");
+    /*
+        byte1: Operating state
+        byte2: Unknown
+        byte3: Unknown
+        byte4: Unknown
+    */
+    uint8_t rx_dat[2 + 4];
+    if (!query_state(0x07, rx_dat, sizeof(rx_dat))) return;
+
+    uint8_t op_state;
+
+    op_state = rx_dat[2];
+
+    ESP_LOGD(TAG, "OP state: %02X" , op_state);
+
+    if (op_state_sensor_ != nullptr) op_state_sensor_->publish_state(op_state);
+  }
+}
+#endif
+
+void Webasto::loop() {
+  switch (poll_step++) {
+#ifdef USE_WEBASTO_KEEP_ALIVE
+    case POLL_KEEP_ALIVE: KeepAlive(); break;
+#endif
+#ifdef USE_WEBASTO_STATE_50_03
+    case POLL_STATE_50_03: get_state_50_03(); break;
+#endif
+#ifdef USE_WEBASTO_STATE_50_04
+    case POLL_STATE_50_04: get_state_50_04(); break;
+#endif
+#ifdef USE_WEBASTO_STATE_50_05
+    case POLL_STATE_50_05: get_state_50_05(); break;
+#endif
+#ifdef USE_WEBASTO_STATE_50_06
+    case POLL_STATE_50_06: get_state_50_06(); break;
+#endif
+#ifdef USE_WEBASTO_STATE_50_07
+    case POLL_STATE_50_07: get_state_50_07(); break;
+#endif
+    default: poll_step = 0; break;
+  }
+
+  uint8_t rxbuf[40];
+  uint8_t rxcnt = 0;
+  while (this->available() && rxcnt < sizeof(rxbuf)) this->read_byte(&rxbuf[rxcnt++]);
+  if (rxcnt > 0) ESP_LOGD(TAG, "%010lu, RX: %s", (unsigned long)millis(), format_hex_pretty(rxbuf, rxcnt).c_str());
+}
+
+void Webasto::dump_config() {
+  ESP_LOGCONFIG(TAG, "Webasto:");
+#ifdef USE_WEBASTO_STATE_50_03
+  LOG_BINARY_SENSOR("  ", "Heat Request", heat_request_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Vent Request", vent_request_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Bit3", bit3_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Bit4", bit4_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Combustion Fan", combustion_fan_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Glowplug", glowplug_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Fuel Pump", fuel_pump_binary_sensor_);
+  LOG_BINARY_SENSOR("  ", "Nozzle Heating", nozzle_heating_binary_sensor_);
+#endif
+#ifdef USE_WEBASTO_STATE_50_04
+  LOG_SENSOR("  ", "Glowplug", glowplug_sensor_);
+  LOG_SENSOR("  ", "Fuel Pump", fuel_pump_sensor_);
+  LOG_SENSOR("  ", "Combustion Fan", combustion_fan_sensor_);
+#endif
+#ifdef USE_WEBASTO_STATE_50_05
+  LOG_SENSOR("  ", "Coolant Temperature", temperature_sensor_);
+  LOG_SENSOR("  ", "Voltage", voltage_sensor_);
+  LOG_SENSOR("  ", "Glowplug Resistance", glowplug_resistance_sensor_);
+#endif
+#ifdef USE_WEBASTO_STATE_50_06
+  LOG_SENSOR("  ", "Working Hours", working_hours_sensor_);
+  LOG_SENSOR("  ", "Operating Hours", operating_hours_sensor_);
+  LOG_SENSOR("  ", "Start Counter", start_counter_sensor_);
+#endif
+#ifdef USE_WEBASTO_STATE_50_07
+  LOG_SENSOR("  ", "OP State", op_state_sensor_);
+#endif
+}
+
+}  // namespace webasto
+}  // namespace esphome
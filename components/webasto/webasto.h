@@ -0,0 +1,193 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/uart/uart.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_BINARY_SENSOR
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#endif
+
+// Queries and commands are only compiled in when the YAML config uses them:
+//   USE_WEBASTO_STATE_50_XX  set by sensor / binary_sensor entries of that status page
+//   USE_WEBASTO_CMD_ON_PH    set by webasto.heat_on
+//   USE_WEBASTO_CMD_ON_VENT  set by webasto.vent_on
+//   USE_WEBASTO_CMD_OFF      set by webasto.off
+#if defined(USE_WEBASTO_CMD_ON_PH) || defined(USE_WEBASTO_CMD_ON_VENT)
+#define USE_WEBASTO_KEEP_ALIVE
+// KeepAlive() renews the on-command until Off() clears it, so Off() must always exist with it
+#ifndef USE_WEBASTO_CMD_OFF
+#define USE_WEBASTO_CMD_OFF
+#endif
+#endif
+#if defined(USE_WEBASTO_STATE_50_03) || defined(USE_WEBASTO_STATE_50_04) || defined(USE_WEBASTO_STATE_50_05) || \
+    defined(USE_WEBASTO_STATE_50_06) || defined(USE_WEBASTO_STATE_50_07)
+#define USE_WEBASTO_STATE
+#endif
+
+namespace esphome {
+namespace webasto {
+
+class Webasto : public Component, public uart::UARTDevice {
+
+    static const uint8_t WBUS_CLIENT_ADDR = 0x0F; // address as client
+    static const uint8_t WBUS_HOST_ADDR   = 0x04; // address as host
+
+    static const uint8_t WBUS_CMD_OFF     = 0x10; /* no data */
+    static const uint8_t WBUS_CMD_ON_PH   = 0x21; /* Parking Heating*/
+    static const uint8_t WBUS_CMD_ON_VENT = 0x22; /* Ventilation */
+    static const uint8_t WBUS_CMD_CHK     = 0x44; /* Check current command (0x20,0x21,0x22 or 0x23) */
+    static const uint8_t WBUS_CMD_STATE   = 0x50; /* Read status page */
+
+    const unsigned long send_break_periode = 30000;
+    unsigned long     last_ok_rx           = millis() - send_break_periode;
+
+#ifdef USE_WEBASTO_KEEP_ALIVE
+    uint8_t         keep_alive_cmd  = 0;
+    unsigned long keep_alive_time   = 0;
+#endif
+
+    // one loop() call per step, disabled queries take no step at all
+    enum poll_step_t : uint8_t {
+#ifdef USE_WEBASTO_KEEP_ALIVE
+      POLL_KEEP_ALIVE,
+#endif
+#ifdef USE_WEBASTO_STATE_50_03
+      POLL_STATE_50_03,
+#endif
+#ifdef USE_WEBASTO_STATE_50_04
+      POLL_STATE_50_04,
+#endif
+#ifdef USE_WEBASTO_STATE_50_05
+      POLL_STATE_50_05,
+#endif
+#ifdef USE_WEBASTO_STATE_50_06
+      POLL_STATE_50_06,
+#endif
+#ifdef USE_WEBASTO_STATE_50_07
+      POLL_STATE_50_07,
+#endif
+      POLL_IDLE,
+    };
+    uint8_t poll_step = 0;
+
+  public:
+#ifdef USE_WEBASTO_STATE_50_03
+    SUB_BINARY_SENSOR(heat_request)
+    SUB_BINARY_SENSOR(vent_request)
+    SUB_BINARY_SENSOR(bit3)
+    SUB_BINARY_SENSOR(bit4)
+    SUB_BINARY_SENSOR(combustion_fan)
+    SUB_BINARY_SENSOR(glowplug)
+    SUB_BINARY_SENSOR(fuel_pump)
+    SUB_BINARY_SENSOR(nozzle_heating)
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_04
+    SUB_SENSOR(glowplug)
+    SUB_SENSOR(fuel_pump)
+    SUB_SENSOR(combustion_fan)
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_05
+    SUB_SENSOR(temperature)
+    SUB_SENSOR(voltage)
+    SUB_SENSOR(glowplug_resistance)
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_06
+    SUB_SENSOR(working_hours)
+    SUB_SENSOR(operating_hours)
+    SUB_SENSOR(start_counter)
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_07
+    SUB_SENSOR(op_state)
+#endif
+
+#ifdef USE_WEBASTO_CMD_ON_VENT
+    void VentOn(uint8_t t_on_mins);
+    void VentOn() {
+      VentOn(1);
+    }
+#endif
+#ifdef USE_WEBASTO_CMD_ON_PH
+    void HeatOn(uint8_t t_on_mins);
+    void HeatOn() {
+      HeatOn(1);
+    }
+#endif
+#ifdef USE_WEBASTO_CMD_OFF
+    void Off();
+#endif
+
+    void setup() override {}
+    void loop() override;
+    void dump_config() override;
+
+  protected:
+    void set_bus_baud_rate(uint32_t baud_rate);
+    void SendBreak();
+    bool tx_msg2(uint8_t* dat, uint8_t len);
+    bool rx_msg2(uint8_t* dat, uint8_t len);
+
+#if defined(USE_WEBASTO_CMD_ON_PH) || defined(USE_WEBASTO_CMD_ON_VENT)
+    bool send_on(const char *name, uint8_t cmd, uint8_t t_on_mins);
+#endif
+#ifdef USE_WEBASTO_KEEP_ALIVE
+    void KeepAlive();
+#endif
+
+#ifdef USE_WEBASTO_STATE
+    // send 0x50 request for status page, check the answer and copy len data bytes to dat
+    bool query_state(uint8_t page, uint8_t* dat, uint8_t len);
+#endif
+
+#ifdef USE_WEBASTO_STATE_50_03
+    void get_state_50_03();
+#endif
+#ifdef USE_WEBASTO_STATE_50_04
+    void get_state_50_04();
+#endif
+#ifdef USE_WEBASTO_STATE_50_05
+    void get_state_50_05();
+#endif
+#ifdef USE_WEBASTO_STATE_50_06
+    void get_state_50_06();
+#endif
+#ifdef USE_WEBASTO_STATE_50_07
+    void get_state_50_07();
+#endif
+};
+
+#ifdef USE_WEBASTO_CMD_ON_PH
+template<typename... Ts> class HeatOnAction : public Action<Ts...>, public Parented<Webasto> {
+  public:
+    explicit HeatOnAction(Webasto *parent) : Parented<Webasto>(parent) {}
+    void play(Ts... x) override { this->parent_->HeatOn(); }
+};
+#endif
+
+#ifdef USE_WEBASTO_CMD_ON_VENT
+template<typename... Ts> class VentOnAction : public Action<Ts...>, public Parented<Webasto> {
+  public:
+    explicit VentOnAction(Webasto *parent) : Parented<Webasto>(parent) {}
+    void play(Ts... x) override { this->parent_->VentOn(); }
+};
+#endif
+
+#ifdef USE_WEBASTO_CMD_OFF
+template<typename... Ts> class OffAction : public Action<Ts...>, public Parented<Webasto> {
+  public:
+    explicit OffAction(Webasto *parent) : Parented<Webasto>(parent) {}
+    void play(Ts... x) override { this->parent_->Off(); }
+};
+#endif
+
+}  // namespace webasto
+}  // namespace esphome